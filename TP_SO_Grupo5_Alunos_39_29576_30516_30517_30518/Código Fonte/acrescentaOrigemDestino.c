@@ -10,6 +10,8 @@
 #include <fcntl.h>
 #include <string.h>
 
+#include "utilitarios.h"
+
 #define BUFFER_SIZE 1024  // Tamanho do buffer para leitura e escrita
 
 /**
@@ -24,9 +26,7 @@ int main(int argc, char *argv[])
     // Verifica se o número de argumentos é correto
     if (argc != 3) 
     {
-        write(2, "Erro: Digite os argumentos: ", 29);
-        write(2, argv[0], strlen(argv[0]));
-        write(2, " nome_ficheiro_origem nome_ficheiro_destino\n", 45);
+        escreveUso(argv[0], " nome_ficheiro_origem nome_ficheiro_destino");
         return 1;
     }
 
@@ -38,7 +38,7 @@ int main(int argc, char *argv[])
     fdInput = open(argv[1], O_RDONLY);
     if (fdInput == -1) 
     {
-        write(2, "Erro na abertura do ficheiro de entrada\n", 41);
+        escreveTexto(2, "Erro na abertura do ficheiro de entrada\n");
         return 1;
     }
 
@@ -46,7 +46,7 @@ int main(int argc, char *argv[])
     fdOutput = open(argv[2], O_WRONLY | O_APPEND);
     if (fdOutput == -1) 
     {
-        write(2, "Erro na abertura ou na criação do ficheiro de saída\n", 56);
+        escreveTexto(2, "Erro na abertura ou na criação do ficheiro de saída\n");
         close(fdInput); 
         return 1;
     }
@@ -57,7 +57,7 @@ int main(int argc, char *argv[])
         tamEscrita = write(fdOutput, buffer, tamLeitura);
         if (tamEscrita != tamLeitura) 
         {
-            write(2, "Erro na escrita do ficheiro de saída\n", 39);
+            escreveTexto(2, "Erro na escrita do ficheiro de saída\n");
             close(fdInput);
             close(fdOutput);
             return 1;
@@ -67,7 +67,7 @@ int main(int argc, char *argv[])
     // Valida se ocorreu algum erro durante a leitura do ficheiro de entrada
     if (tamLeitura == -1) 
     {
-        write(2, "Erro na leitura do ficheiro de entrada\n", 40);
+        escreveTexto(2, "Erro na leitura do ficheiro de entrada\n");
         close(fdInput);
         close(fdOutput);
         return 1;
@@ -76,18 +76,18 @@ int main(int argc, char *argv[])
     // Fecho dos ficheiros de entrada e saída
     if (close(fdInput) == -1) 
     {
-        write(2, "Erro no fecho do ficheiro de entrada\n", 38);
+        escreveTexto(2, "Erro no fecho do ficheiro de entrada\n");
         return 1;
     }
 
     if (close(fdOutput) == -1) 
     {
-        write(2, "Erro no fecho do ficheiro de saída\n", 37);
+        escreveTexto(2, "Erro no fecho do ficheiro de saída\n");
         return 1;
     }
 
     // Caso não existam erros, indica que os dados foram inseridos com sucesso
-    write(1, "Dados inseridos com sucesso\n", 29);
+    escreveTexto(1, "Dados inseridos com sucesso\n");
 
     return 0;  // Sucesso
 }
\ No newline at end of file
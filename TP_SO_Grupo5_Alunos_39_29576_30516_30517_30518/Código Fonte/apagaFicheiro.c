@@ -2,7 +2,7 @@
  * @file apagaFicheiro.c
  * @brief Programa para eliminar um ficheiro.
  *
- * Este programa recebe o nome de um ficheiro como argumento e procede à sua eliminação.
+ * Este programa recebe o nome de um ou mais ficheiros como argumento e procede à sua eliminação.
  * Se o ficheiro for eliminado com sucesso, é retornada uma mensagem de sucesso. Caso contrário, retorna uma mensagem de erro.
  */
 
@@ -10,6 +10,8 @@
 #include <stdio.h>    // Acesso à função remove() e descritor de ficheiro STDOUT
 #include <string.h>
 
+#include "utilitarios.h"
+
 /**
  * @brief Função principal do programa.
  *
@@ -20,22 +22,31 @@
 int main(int argc, char *argv[]) 
 {
     // Verifica se o número de argumentos é correto
-    if (argc != 2) 
+    if (argc < 2) 
     {
-        write(2, "Erro: Digite os argumentos: ", 29);
-        write(2, argv[0], strlen(argv[0]));
-        write(2, " <nome_ficheiro>\n", 18);
+        escreveUso(argv[0], " <nome_ficheiro>...");
         return 1;
     }
 
-    // Elimina o ficheiro passado como argumento
-    if (unlink(argv[1]) == -1) 
+    // Elimina os ficheiros passados como argumento
+    int erro = 0;
+    for (int i = 1; i < argc; i++) 
+    {
+        if (unlink(argv[i]) == -1) 
+        {
+            escreveTexto(2, "Erro na eliminação do ficheiro ");
+            escreveTexto(2, argv[i]);
+            escreveTexto(2, "\n");
+            erro = 1;
+        }
+    }
+
+    if (erro) 
     {
-        write(2, "Erro na eliminação do ficheiro\n", 34);
         return 1;
     }
 
-    write(1, "Eliminação do ficheiro efetuada com sucesso\n", 47);
+    escreveTexto(1, "Eliminação do ficheiro efetuada com sucesso\n");
 
     return 0;
 }
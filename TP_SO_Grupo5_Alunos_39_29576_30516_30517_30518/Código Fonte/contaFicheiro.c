@@ -2,7 +2,7 @@
  * @file contaficheiro.c
  * @brief Programa para contar o número de linhas de um ficheiro.
  *
- * Este programa recebe o nome de um ficheiro como argumento e conta o número de linhas que consta no ficheiro.
+ * Este programa recebe o nome de um ou mais ficheiros como argumento e conta o número de linhas que consta em cada ficheiro.
  * O programa imprime o número total de linhas no ficheiro no stdout.
  * Se existirem erros durante a abertura, leitura ou fecho do ficheiro, são devolvidas mensagens de erro.
  */
@@ -11,32 +11,28 @@
 #include <fcntl.h>    // Função open() e definições de flags
 #include <string.h>
 
+#include "utilitarios.h"
+
 /**
- * @brief Função principal do programa.
+ * @brief Conta o número de linhas de um ficheiro e escreve-o no stdout.
  *
- * @param argc Número de argumentos passados na linha de comandos.
- * @param argv Vetor de argumentos passados na linha de comandos.
+ * @param nome Nome do ficheiro.
+ * @param mostraNome Indica se o nome do ficheiro é escrito a seguir ao número de linhas.
  * @return Retorna 0 em caso de sucesso, 1 em caso de erro.
  */
-int main(int argc, char *argv[]) 
+static int contaFicheiro(const char *nome, int mostraNome)
 {
-    // Verifica se o número de argumentos é o correto
-    if (argc != 2) {
-        write(2, "Erro: Digite os argumentos: ", 29);
-        write(2, argv[0], strlen(argv[0]));
-        write(2, " <nome_ficheiro>\n", 18);
-        return 1;
-    }
-
-    int fd, temp;
+    int fd;
     char ch;
     int numLinhas = 0;
 
     // Abertura do ficheiro para leitura
-    fd = open(argv[1], O_RDONLY);
+    fd = open(nome, O_RDONLY);
     if (fd == -1) 
     {
-        write(2, "Erro na abertura do ficheiro\n", 30); 
+        escreveTexto(2, "Erro na abertura do ficheiro ");
+        escreveTexto(2, nome);
+        escreveTexto(2, "\n");
         return 1;
     }
 
@@ -52,29 +48,49 @@ int main(int argc, char *argv[])
     // Fecho do ficheiro
     if (close(fd) == -1) 
     {
-        write(2, "Erro no fecho do ficheiro\n", 27);
+        escreveTexto(2, "Erro no fecho do ficheiro ");
+        escreveTexto(2, nome);
+        escreveTexto(2, "\n");
         return 1;
     }
 
     // Adiciona linha extra
     numLinhas++;
 
-    // Converte o número de linhas para uma string
-    char linhaString[20];
-    int len = 0;
-    temp = numLinhas;
-    do 
+    // Escreve o número de linhas no terminal
+    escreveNumero(1, numLinhas);
+    if (mostraNome)
     {
-        linhaString[len++] = temp % 10 + '0';
-        temp /= 10;
-    } while (temp);
+        escreveTexto(1, " ");
+        escreveTexto(1, nome);
+    }
+    escreveTexto(1, "\n");
+
+    return 0;
+}
+
+/**
+ * @brief Função principal do programa.
+ *
+ * Com vários ficheiros, cada contagem é seguida do nome do respetivo ficheiro.
+ *
+ * @param argc Número de argumentos passados na linha de comandos.
+ * @param argv Vetor de argumentos passados na linha de comandos.
+ * @return Retorna 0 em caso de sucesso, 1 em caso de erro.
+ */
+int main(int argc, char *argv[]) 
+{
+    // Verifica se o número de argumentos é o correto
+    if (argc < 2) {
+        escreveUso(argv[0], " <nome_ficheiro>...");
+        return 1;
+    }
 
-    // Escreve a string relativa ao número de linhas, invertida no terminal
-    for (int i = len - 1; i >= 0; i--) 
+    int erro = 0;
+    for (int i = 1; i < argc; i++) 
     {
-        write(1, &linhaString[i], 1);
+        erro |= contaFicheiro(argv[i], argc > 2);
     }
-    write(1, "\n", 1);
 
-    return 0;
+    return erro;
 }
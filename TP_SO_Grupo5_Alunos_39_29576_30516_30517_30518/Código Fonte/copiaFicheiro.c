@@ -3,6 +3,9 @@
  * @brief Programa para copiar o conteúdo de um ficheiro para outro.
  *
  * Este programa recebe um ficheiro como argumento e efetua uma cópia do seu conteúdo para outro ficheiro.
+ * Por omissão o destino é "ficheiro.copia"; pode ser indicado outro como segundo argumento.
+ * Com a opção --delta, o destino existente é comparado bloco a bloco com a origem e só os blocos
+ * diferentes são reescritos, sendo indicado no fim o número de bytes efetivamente escritos.
  * Se ocorrerem erros durante a abertura, leitura, escrita ou no fecho dos ficheiros, são retornadas mensagens de erro.
  */
 
@@ -11,7 +14,109 @@
 #include <sys/stat.h>      // Permissões de ficheiros
 #include <string.h>
 
+#include "utilitarios.h"
+
 #define BUFFER_SIZE 1024   // Tamanho do buffer usado para leitura e escrita
+#define DELTA_BLOCO 65536  // Tamanho dos blocos comparados no modo --delta
+
+/**
+ * @brief Lê até tam bytes a partir de pos, repetindo pread() até ao fim do ficheiro.
+ *
+ * @return Número de bytes lidos (menor do que tam apenas no fim do ficheiro), ou -1 em caso de erro.
+ */
+static ssize_t leBloco(int fd, char *buffer, size_t tam, off_t pos)
+{
+    size_t lidos = 0;
+    while (lidos < tam)
+    {
+        ssize_t r = pread(fd, buffer + lidos, tam - lidos, pos + lidos);
+        if (r == -1)
+            return -1;
+        if (r == 0)
+            break;
+        lidos += r;
+    }
+    return lidos;
+}
+
+/**
+ * @brief Atualiza o destino reescrevendo apenas os blocos que diferem da origem.
+ *
+ * A origem tem de ser um ficheiro regular, pois o seu tamanho é obtido com fstat().
+ * Origem e destino são lidos com pread() e comparados em blocos de DELTA_BLOCO bytes com memcmp().
+ * Os blocos diferentes (e os que excedem o tamanho atual do destino) são escritos com pwrite() e,
+ * no fim, o destino é truncado para o tamanho da origem. Se a origem mudar de tamanho durante a
+ * cópia, a operação falha sem truncar o destino.
+ *
+ * @param fdInput Descritor do ficheiro de origem, aberto para leitura.
+ * @param fdOutput Descritor do ficheiro de destino, aberto para leitura e escrita.
+ * @param escritos Número de bytes efetivamente escritos no destino.
+ * @return Retorna 0 em caso de sucesso, 1 em caso de erro.
+ */
+static int copiaDelta(int fdInput, int fdOutput, unsigned long long *escritos)
+{
+    static char origem[DELTA_BLOCO], destino[DELTA_BLOCO];
+    struct stat stInput, stOutput;
+    *escritos = 0;
+
+    if (fstat(fdInput, &stInput) == -1 || fstat(fdOutput, &stOutput) == -1) 
+    {
+        escreveTexto(2, "Erro na leitura das informações do ficheiro\n");
+        return 1;
+    }
+
+    off_t tamInput = stInput.st_size;
+    for (off_t pos = 0; pos < tamInput; pos += DELTA_BLOCO) 
+    {
+        size_t tam = tamInput - pos < DELTA_BLOCO ? tamInput - pos : DELTA_BLOCO;
+
+        ssize_t lidos = leBloco(fdInput, origem, tam, pos);
+        if (lidos == -1) 
+        {
+            escreveTexto(2, "Erro na leitura do ficheiro de entrada\n");
+            return 1;
+        }
+        if ((size_t)lidos != tam) 
+        {
+            escreveTexto(2, "Erro: origem alterada durante a cópia\n");
+            return 1;
+        }
+
+        // Blocos presentes e iguais no destino não são reescritos
+        lidos = leBloco(fdOutput, destino, tam, pos);
+        if (lidos == -1) 
+        {
+            escreveTexto(2, "Erro na leitura do ficheiro de saída\n");
+            return 1;
+        }
+        if ((size_t)lidos == tam && memcmp(origem, destino, tam) == 0)
+            continue;
+
+        if (pwrite(fdOutput, origem, tam, pos) != (ssize_t)tam) 
+        {
+            escreveTexto(2, "Erro na escrita do ficheiro de saída\n");
+            return 1;
+        }
+        *escritos += tam;
+    }
+
+    // Se a origem mudou de tamanho, o destino não é truncado
+    if (fstat(fdInput, &stInput) == -1 || stInput.st_size != tamInput) 
+    {
+        escreveTexto(2, "Erro: origem alterada durante a cópia\n");
+        return 1;
+    }
+
+    // Acerta o tamanho do destino quando este era maior do que a origem
+    if (fstat(fdOutput, &stOutput) == -1 ||
+        (stOutput.st_size != tamInput && ftruncate(fdOutput, tamInput) == -1)) 
+    {
+        escreveTexto(2, "Erro no ajuste do tamanho do ficheiro de saída\n");
+        return 1;
+    }
+
+    return 0;
+}
 
 /**
  * @brief Função principal do programa.
@@ -25,39 +130,78 @@ int main(int argc, char *argv[])
     char buffer[BUFFER_SIZE];   // Buffer para guardar os dados lidos do ficheiro
     ssize_t tam;                // Tamanho dos dados lidos
     int fdInput, fdOutput;      // Descritores de ficheiro para o ficheiro de entrada e de saída
+    int delta = 0;              // Modo --delta: reescreve apenas os blocos alterados
+    const char *destino = "ficheiro.copia";
+
+    // Opção --delta antes dos ficheiros
+    if (argc > 1 && strcmp(argv[1], "--delta") == 0) 
+    {
+        delta = 1;
+        argv[1] = argv[0];
+        argv++;
+        argc--;
+    }
 
     // Valida se o número de argumentos é o correto
-    if (argc != 2) 
+    if (argc != 2 && argc != 3) 
     {
-        write(2, "Erro: Digite os argumentos: ", 29);
-        write(2, argv[0], strlen(argv[0]));
-        write(2, " <nome_ficheiro>\n", 18);
+        escreveUso(argv[0], " [--delta] <nome_ficheiro> [destino]");
         return 1;
     }
+    if (argc == 3) 
+    {
+        destino = argv[2];
+    }
 
     // Abre o ficheiro de entrada para leitura
     fdInput = open(argv[1], O_RDONLY);
     if (fdInput == -1) 
     {
-        write(2, "Ficheiro não encontrado\n", 26);
+        escreveTexto(2, "Ficheiro não encontrado\n");
         return 1;
     }
 
+    // O modo --delta depende do tamanho da origem: pipes e ficheiros especiais são copiados por inteiro
+    struct stat stInput;
+    if (delta && (fstat(fdInput, &stInput) == -1 || !S_ISREG(stInput.st_mode))) 
+    {
+        delta = 0;
+    }
+
     // Abre ou cria o ficheiro de saída para escrita
-    fdOutput = open("ficheiro.copia", O_CREAT | O_WRONLY, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+    fdOutput = open(destino, O_CREAT | (delta ? O_RDWR : O_WRONLY | O_TRUNC), S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
     if (fdOutput == -1) 
     {
-        write(2, "Erro na abertura ou na criação do ficheiro de saída\n", 56);
+        escreveTexto(2, "Erro na abertura ou na criação do ficheiro de saída\n");
         close(fdInput); 
         return 1;
     }
 
+    if (delta) 
+    {
+        unsigned long long escritos;
+        int erro = copiaDelta(fdInput, fdOutput, &escritos);
+        close(fdInput);
+        if (close(fdOutput) == -1) 
+        {
+            escreveTexto(2, "Erro no fecho do ficheiro de saída\n");
+            erro = 1;
+        }
+        if (erro)
+            return 1;
+
+        escreveTexto(1, "Ficheiro atualizado com sucesso: ");
+        escreveNumero(1, escritos);
+        escreveTexto(1, " bytes escritos\n");
+        return 0;
+    }
+
     // Copia o conteúdo do ficheiro de entrada para o ficheiro de saída
     while ((tam = read(fdInput, buffer, BUFFER_SIZE)) > 0) 
     {
         if (write(fdOutput, buffer, tam) != tam) 
         {
-            write(2, "Erro na escrita do ficheiro de saída\n", 39);
+            escreveTexto(2, "Erro na escrita do ficheiro de saída\n");
             close(fdInput);
             close(fdOutput);
             return 1;
@@ -67,7 +211,7 @@ int main(int argc, char *argv[])
     // Valida se ocorreu algum erro durante a leitura do ficheiro de entrada
     if (tam == -1) 
     {
-        write(2, "Erro na leitura do ficheiro de entrada\n", 40);
+        escreveTexto(2, "Erro na leitura do ficheiro de entrada\n");
         close(fdInput);
         close(fdOutput);
         return 1;
@@ -77,7 +221,7 @@ int main(int argc, char *argv[])
     close(fdInput);
     close(fdOutput);
 
-    write(1, "Ficheiro criado com sucesso\n", 28);
+    escreveTexto(1, "Ficheiro criado com sucesso\n");
 
     return 0;
 }
@@ -14,6 +14,8 @@
 #include <stdlib.h>    // Função exit()
 #include <string.h>    // Função strlen()
 
+#include "utilitarios.h"
+
 /**
  * @brief Função principal do programa.
  *
@@ -26,9 +28,7 @@ int main(int argc, char *argv[])
     // Verifica se o argumento do ficheiro foi passado
     if (argc < 2) 
     {
-        write(2, "Erro: Digite os argumentos: ", 29);
-        write(2, argv[0], strlen(argv[0]));
-        write(2, " nome_ficheiro\n", 16);
+        escreveUso(argv[0], " nome_ficheiro");
         return 1;
     }
 
@@ -39,93 +39,57 @@ int main(int argc, char *argv[])
     if (stat(filename, &file_info) == -1) 
     {
         const char *error = "Erro na leitura das informações do ficheiro\n";
-        write(2, error, 47);
+        escreveTexto(2, error);
         return 1;
     }
 
     // Determina e imprime o tipo do ficheiro
     if (S_ISREG(file_info.st_mode))
-        write(1, "Tipo de ficheiro: Ficheiro regular\n", 36);
+        escreveTexto(1, "Tipo de ficheiro: Ficheiro regular\n");
     else if (S_ISDIR(file_info.st_mode))
-        write(1, "Tipo de ficheiro: Diretoria\n", 29);
+        escreveTexto(1, "Tipo de ficheiro: Diretoria\n");
     else if (S_ISLNK(file_info.st_mode))
-        write(1, "Tipo de ficheiro: Link\n", 24);
+        escreveTexto(1, "Tipo de ficheiro: Link\n");
     else if (S_ISCHR(file_info.st_mode))
-        write(1, "Tipo de ficheiro: Ficheiro especial de caracteres\n", 51);
+        escreveTexto(1, "Tipo de ficheiro: Ficheiro especial de caracteres\n");
     else if (S_ISBLK(file_info.st_mode))
-        write(1, "Tipo de ficheiro: Ficheiro especial de blocos\n", 47);
+        escreveTexto(1, "Tipo de ficheiro: Ficheiro especial de blocos\n");
     else
-        write(1, "Tipo de ficheiro: Outro\n", 25);
+        escreveTexto(1, "Tipo de ficheiro: Outro\n");
 
     // Converte e imprime o inode do ficheiro
-    write(1, "Inode do ficheiro: ", 20);
-    char inode_str[20];
-    int inode_length = 0;
-    int temp_inode = file_info.st_ino;
-    if (temp_inode == 0) 
-    {
-        inode_str[0] = '0';
-        inode_length = 1;
-    } else 
-    {
-        while (temp_inode != 0) 
-        {
-            inode_str[inode_length++] = (temp_inode % 10) + '0';
-            temp_inode /= 10;
-        }
-    }
-    for (int i = inode_length - 1; i >= 0; i--) 
-    {
-        write(1, &inode_str[i], 1);
-    }
-    write(1, "\n", 1);
+    escreveTexto(1, "Inode do ficheiro: ");
+    escreveNumero(1, file_info.st_ino);
+    escreveTexto(1, "\n");
 
     // Determina e imprime o Proprietário do ficheiro
     struct passwd *pw = getpwuid(file_info.st_uid);
     if (pw != NULL) 
     {
         const char *owner = "Proprietário do ficheiro: ";
-        write(1, owner, 28);
-        write(1, pw->pw_name, strlen(pw->pw_name));
-        write(1, "\n", 1);
+        escreveTexto(1, owner);
+        escreveTexto(1, pw->pw_name);
+        escreveTexto(1, "\n");
     } else {
-        char uid_str[20];
-        int uid_length = 0;
-        int temp_uid = file_info.st_uid;
-        if (temp_uid == 0) 
-        {
-            uid_str[0] = '0';
-            uid_length = 1;
-        } else 
-        {
-            while (temp_uid != 0) 
-            {
-                uid_str[uid_length++] = (temp_uid % 10) + '0';
-                temp_uid /= 10;
-            }
-        }
-        for (int i = uid_length - 1; i >= 0; i--) 
-        {
-            write(1, &uid_str[i], 1);
-        }
-        write(1, "\n", 1);
+        escreveNumero(1, file_info.st_uid);
+        escreveTexto(1, "\n");
     }
 
     // Imprime a data de criação do ficheiro
     const char *creation = "Data da criação do ficheiro: ";
-    write(1, creation, 32);
+    escreveTexto(1, creation);
     write(1, ctime(&file_info.st_ctime), 24);
 
     // Imprime a data da última leitura do ficheiro
     const char *access = "\nData da última leitura do ficheiro: ";
-    write(1, access, 39);
+    escreveTexto(1, access);
     write(1, ctime(&file_info.st_atime), 24);
 
     // Imprime a data da última modificação do ficheiro
     const char *modification = "\nData da última modificação do ficheiro: ";
-    write(1, modification, 45);
+    escreveTexto(1, modification);
     write(1, ctime(&file_info.st_mtime), 24);
-    write(1, "\n", 1);
+    escreveTexto(1, "\n");
     
     return 0;
 }
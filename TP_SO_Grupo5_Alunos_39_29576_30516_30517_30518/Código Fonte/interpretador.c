@@ -13,16 +13,548 @@
  * - lista
  * - termina
  * - help
+ *
+ * Os argumentos são expandidos pelo interpretador antes da execução: chavetas ({a,b}), padrões
+ * (*, ?, [...]) e '**' para qualquer número de subdiretorias. As diretorias lidas durante a
+ * expansão ficam em cache até ao fim da linha de comando. Os comandos que aceitam vários
+ * ficheiros recebem a lista expandida no menor número de execuções que o limite ARG_MAX permite.
  */
 
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <sys/wait.h>
+#include <sys/stat.h>
 #include <unistd.h>
 #include <errno.h>
+#include <dirent.h>
+#include <fnmatch.h>
+
+#include "utilitarios.h"
+
+#define MAX_LENGTH 1024        // Tamanho máximo do buffer para comandos.
+#define CACHE_BUCKETS 4096     // Número de entradas da tabela de dispersão da cache de diretorias.
+#define ARG_MAX_FOLGA 4096     // Margem reservada abaixo de ARG_MAX para cada execução.
+
+#define OPERANDOS_LITERAIS 0   // Argumentos passados tal como foram expandidos, numa só execução.
+#define OPERANDOS_UM 1         // O comando aceita um único ficheiro: uma execução por ficheiro.
+#define OPERANDOS_VARIOS 2     // O comando aceita vários ficheiros: execuções agrupadas até ARG_MAX.
+
+#define ENTRADA_DIR 1          // A entrada é (ou aponta para) uma diretoria.
+#define ENTRADA_LINK 2         // A entrada é uma ligação simbólica.
+
+extern char **environ;
+
+/**
+ * @brief Comando reconhecido pelo interpretador e forma como recebe os operandos.
+ */
+typedef struct
+{
+    const char *nome;
+    int operandos;
+} Comando;
+
+static const Comando comandos[] = {
+    { "mostra",     OPERANDOS_VARIOS },
+    { "copia",      OPERANDOS_LITERAIS },
+    { "acrescenta", OPERANDOS_LITERAIS },
+    { "conta",      OPERANDOS_VARIOS },
+    { "apaga",      OPERANDOS_VARIOS },
+    { "informa",    OPERANDOS_UM },
+    { "lista",      OPERANDOS_LITERAIS },
+};
+
+/**
+ * @brief Lista dinâmica de strings alocadas.
+ */
+typedef struct
+{
+    char **itens;
+    size_t n, cap;
+} ListaStrings;
+
+/**
+ * @brief Entrada de uma diretoria guardada em cache.
+ */
+typedef struct
+{
+    char *nome;
+    int tipo;   // Combinação de ENTRADA_DIR e ENTRADA_LINK
+} Entrada;
+
+/**
+ * @brief Conteúdo de uma diretoria lida durante a expansão de uma linha de comando.
+ */
+typedef struct Diretoria
+{
+    char *caminho;
+    Entrada *entradas;
+    size_t n;
+    struct Diretoria *seguinte;
+} Diretoria;
+
+static Diretoria *cache[CACHE_BUCKETS];
+
+static char *duplica(const char *s, size_t len)
+{
+    char *copia = realoca(NULL, len + 1);
+    memcpy(copia, s, len);
+    copia[len] = '\0';
+    return copia;
+}
+
+static void adicionaString(ListaStrings *lista, char *s)
+{
+    if (lista->n == lista->cap)
+    {
+        lista->cap = lista->cap ? lista->cap * 2 : 16;
+        lista->itens = realoca(lista->itens, lista->cap * sizeof(char *));
+    }
+    lista->itens[lista->n++] = s;
+}
+
+static void libertaLista(ListaStrings *lista)
+{
+    for (size_t i = 0; i < lista->n; i++)
+        free(lista->itens[i]);
+    free(lista->itens);
+    lista->itens = NULL;
+    lista->n = lista->cap = 0;
+}
+
+static int comparaStrings(const void *a, const void *b)
+{
+    return strcmp(*(char *const *)a, *(char *const *)b);
+}
+
+static int comparaEntradas(const void *a, const void *b)
+{
+    return strcmp(((const Entrada *)a)->nome, ((const Entrada *)b)->nome);
+}
+
+/**
+ * @brief Junta um nome a um caminho base ("" representa a diretoria atual).
+ */
+static char *juntaCaminho(const char *base, const char *nome)
+{
+    size_t lb = strlen(base), ln = strlen(nome);
+    int barra = lb > 0 && base[lb - 1] != '/';
+    char *r = realoca(NULL, lb + barra + ln + 1);
+    memcpy(r, base, lb);
+    if (barra)
+        r[lb] = '/';
+    memcpy(r + lb + barra, nome, ln + 1);
+    return r;
+}
+
+static unsigned long dispersao(const char *s)
+{
+    unsigned long h = 5381;
+    while (*s)
+        h = h * 33 + (unsigned char)*s++;
+    return h % CACHE_BUCKETS;
+}
+
+/**
+ * @brief Devolve o conteúdo de uma diretoria, lendo-a apenas na primeira utilização.
+ *
+ * @param caminho Caminho da diretoria ("" para a diretoria atual).
+ * @return Diretoria em cache, ou NULL se não for possível abri-la.
+ */
+static Diretoria *leDiretoria(const char *caminho)
+{
+    unsigned long h = dispersao(caminho);
+    for (Diretoria *d = cache[h]; d != NULL; d = d->seguinte)
+    {
+        if (strcmp(d->caminho, caminho) == 0)
+            return d;
+    }
+
+    DIR *dir = opendir(caminho[0] ? caminho : ".");
+    if (!dir)
+        return NULL;
+
+    Diretoria *d = realoca(NULL, sizeof(Diretoria));
+    d->caminho = duplica(caminho, strlen(caminho));
+    d->entradas = NULL;
+    d->n = 0;
+    size_t cap = 0;
+
+    struct dirent *entry;
+    while ((entry = readdir(dir)))
+    {
+        if (entry->d_name[0] == '.' && (entry->d_name[1] == '\0' ||
+            (entry->d_name[1] == '.' && entry->d_name[2] == '\0')))
+            continue;
+
+        int tipo = 0;
+        if (entry->d_type == DT_DIR)
+            tipo = ENTRADA_DIR;
+        else if (entry->d_type == DT_LNK || entry->d_type == DT_UNKNOWN)
+        {
+            // Só as ligações e os sistemas de ficheiros sem d_type obrigam a um stat
+            struct stat st;
+            char *completo = juntaCaminho(caminho, entry->d_name);
+            if (lstat(completo, &st) == 0)
+            {
+                if (S_ISLNK(st.st_mode))
+                {
+                    tipo = ENTRADA_LINK;
+                    if (stat(completo, &st) == 0 && S_ISDIR(st.st_mode))
+                        tipo |= ENTRADA_DIR;
+                }
+                else if (S_ISDIR(st.st_mode))
+                    tipo = ENTRADA_DIR;
+            }
+            free(completo);
+        }
 
-#define MAX_LENGTH 1024 // Tamanho máximo do buffer para comandos.
+        if (d->n == cap)
+        {
+            cap = cap ? cap * 2 : 32;
+            d->entradas = realoca(d->entradas, cap * sizeof(Entrada));
+        }
+        d->entradas[d->n].nome = duplica(entry->d_name, strlen(entry->d_name));
+        d->entradas[d->n].tipo = tipo;
+        d->n++;
+    }
+    closedir(dir);
+
+    qsort(d->entradas, d->n, sizeof(Entrada), comparaEntradas);
+    d->seguinte = cache[h];
+    cache[h] = d;
+    return d;
+}
+
+/**
+ * @brief Liberta a cache de diretorias no fim de cada linha de comando.
+ */
+static void limpaCache(void)
+{
+    for (int i = 0; i < CACHE_BUCKETS; i++)
+    {
+        while (cache[i] != NULL)
+        {
+            Diretoria *d = cache[i];
+            cache[i] = d->seguinte;
+            for (size_t j = 0; j < d->n; j++)
+                free(d->entradas[j].nome);
+            free(d->entradas);
+            free(d->caminho);
+            free(d);
+        }
+    }
+}
+
+/**
+ * @brief Expande a primeira expressão de chavetas de um padrão, recursivamente.
+ *
+ * "a{b,c{d,e}}f" dá origem a "abf", "acdf" e "acef". Chavetas sem vírgula ou sem fecho
+ * são mantidas literalmente.
+ */
+static void expandeChavetas(const char *padrao, ListaStrings *resultado)
+{
+    for (const char *abre = padrao; (abre = strchr(abre, '{')) != NULL; abre++)
+    {
+        // Procura o fecho correspondente e as vírgulas de nível superior
+        int nivel = 0, virgulas = 0;
+        const char *fecha = NULL;
+        for (const char *p = abre + 1; *p && fecha == NULL; p++)
+        {
+            if (*p == '{')
+                nivel++;
+            else if (*p == '}' && nivel > 0)
+                nivel--;
+            else if (*p == '}')
+                fecha = p;
+            else if (*p == ',' && nivel == 0)
+                virgulas++;
+        }
+        if (fecha == NULL || virgulas == 0)
+            continue;
+
+        size_t lenPrefixo = abre - padrao;
+        size_t lenSufixo = strlen(fecha + 1);
+        const char *inicio = abre + 1;
+        nivel = 0;
+        for (const char *p = abre + 1; p <= fecha; p++)
+        {
+            if (*p == '{')
+                nivel++;
+            else if (*p == '}' && p != fecha)
+                nivel--;
+            else if ((*p == ',' && nivel == 0) || p == fecha)
+            {
+                size_t lenAlt = p - inicio;
+                char *novo = realoca(NULL, lenPrefixo + lenAlt + lenSufixo + 1);
+                memcpy(novo, padrao, lenPrefixo);
+                memcpy(novo + lenPrefixo, inicio, lenAlt);
+                memcpy(novo + lenPrefixo + lenAlt, fecha + 1, lenSufixo + 1);
+                expandeChavetas(novo, resultado);
+                free(novo);
+                inicio = p + 1;
+            }
+        }
+        return;
+    }
+
+    adicionaString(resultado, duplica(padrao, strlen(padrao)));
+}
+
+static int temCuringa(const char *s)
+{
+    return strpbrk(s, "*?[") != NULL;
+}
+
+/**
+ * @brief Percorre os componentes de um padrão a partir de um caminho base.
+ *
+ * @param base Caminho já resolvido.
+ * @param comps Componentes do padrão (separados por '/').
+ * @param n Número de componentes.
+ * @param idx Componente a resolver.
+ * @param verificado Indica se a base foi confirmada por uma leitura de diretoria.
+ * @param soDiretorias O padrão termina em '/' e só aceita diretorias.
+ * @param resultado Lista onde são guardados os caminhos encontrados.
+ */
+static void expandeComponentes(const char *base, char **comps, int n, int idx,
+                               int verificado, int soDiretorias, ListaStrings *resultado)
+{
+    if (idx == n)
+    {
+        struct stat st;
+        if (!verificado || soDiretorias)
+        {
+            if (stat(base, &st) == -1 && lstat(base, &st) == -1)
+                return;
+            if (soDiretorias && !S_ISDIR(st.st_mode))
+                return;
+        }
+        adicionaString(resultado, soDiretorias ? juntaCaminho(base, "") : duplica(base, strlen(base)));
+        return;
+    }
+
+    const char *comp = comps[idx];
+    int ultimo = idx == n - 1;
+
+    // Componente sem curingas: não é preciso ler a diretoria
+    if (!temCuringa(comp))
+    {
+        char *caminho = juntaCaminho(base, comp);
+        expandeComponentes(caminho, comps, n, idx + 1, 0, soDiretorias, resultado);
+        free(caminho);
+        return;
+    }
+
+    Diretoria *d = leDiretoria(base);
+    if (d == NULL)
+        return;
+
+    if (strcmp(comp, "**") == 0)
+    {
+        // Zero subdiretorias: o resto do padrão aplica-se à própria base
+        if (!ultimo)
+            expandeComponentes(base, comps, n, idx + 1, 1, soDiretorias, resultado);
+
+        for (size_t i = 0; i < d->n; i++)
+        {
+            Entrada *e = &d->entradas[i];
+            if (e->nome[0] == '.')
+                continue;
+            char *caminho = juntaCaminho(base, e->nome);
+            if (ultimo && (!soDiretorias || (e->tipo & ENTRADA_DIR)))
+                adicionaString(resultado, soDiretorias ? juntaCaminho(caminho, "") : duplica(caminho, strlen(caminho)));
+            // Não segue ligações simbólicas para evitar ciclos
+            if (e->tipo == ENTRADA_DIR)
+                expandeComponentes(caminho, comps, n, idx, 1, soDiretorias, resultado);
+            free(caminho);
+        }
+        return;
+    }
+
+    for (size_t i = 0; i < d->n; i++)
+    {
+        Entrada *e = &d->entradas[i];
+        if (!ultimo && !(e->tipo & ENTRADA_DIR))
+            continue;
+        if (fnmatch(comp, e->nome, FNM_PERIOD) != 0)
+            continue;
+        char *caminho = juntaCaminho(base, e->nome);
+        expandeComponentes(caminho, comps, n, idx + 1, 1, soDiretorias, resultado);
+        free(caminho);
+    }
+}
+
+/**
+ * @brief Expande um argumento (chavetas e curingas) e acrescenta o resultado à lista.
+ *
+ * Padrões sem correspondência são mantidos literalmente, como numa shell.
+ */
+static void expandeArgumento(const char *arg, ListaStrings *resultado)
+{
+    ListaStrings padroes = { 0 };
+    expandeChavetas(arg, &padroes);
+
+    for (size_t p = 0; p < padroes.n; p++)
+    {
+        char *padrao = padroes.itens[p];
+        if (!temCuringa(padrao))
+        {
+            adicionaString(resultado, padrao);
+            padroes.itens[p] = NULL;
+            continue;
+        }
+
+        // Divide o padrão em componentes, sobre uma cópia (strtok está em uso no ciclo principal)
+        size_t len = strlen(padrao);
+        char *copia = duplica(padrao, len);
+        int soDiretorias = len > 1 && padrao[len - 1] == '/';
+        char **comps = realoca(NULL, (len / 2 + 1) * sizeof(char *));
+        int n = 0;
+        for (char *c = copia; *c; )
+        {
+            char *fim = strchr(c, '/');
+            if (fim != NULL)
+                *fim = '\0';
+            if (*c)
+                comps[n++] = c;
+            if (fim == NULL)
+                break;
+            c = fim + 1;
+        }
+
+        ListaStrings encontrados = { 0 };
+        expandeComponentes(padrao[0] == '/' ? "/" : "", comps, n, 0, 0, soDiretorias, &encontrados);
+        free(comps);
+        free(copia);
+
+        if (encontrados.n == 0)
+        {
+            adicionaString(resultado, padrao);
+            padroes.itens[p] = NULL;
+            continue;
+        }
+
+        // Ordena e remove repetidos (por exemplo, "**/**")
+        qsort(encontrados.itens, encontrados.n, sizeof(char *), comparaStrings);
+        for (size_t i = 0; i < encontrados.n; i++)
+        {
+            if (i > 0 && strcmp(encontrados.itens[i], encontrados.itens[i - 1]) == 0)
+                free(encontrados.itens[i]);
+            else
+                adicionaString(resultado, encontrados.itens[i]);
+        }
+        free(encontrados.itens);
+    }
+
+    libertaLista(&padroes);
+}
+
+/**
+ * @brief Calcula o espaço disponível para argumentos numa execução.
+ *
+ * Ao valor de ARG_MAX é descontado o ambiente herdado pelo processo filho e uma margem de segurança.
+ */
+static size_t espacoArgumentos(void)
+{
+    long argMax = sysconf(_SC_ARG_MAX);
+    if (argMax <= 0)
+        argMax = 131072;
+
+    size_t ambiente = 0;
+    for (char **e = environ; *e != NULL; e++)
+        ambiente += strlen(*e) + 1 + sizeof(char *);
+
+    if ((size_t)argMax <= ambiente + 2 * ARG_MAX_FOLGA)
+        return ARG_MAX_FOLGA;
+    return (size_t)argMax - ambiente - ARG_MAX_FOLGA;
+}
+
+/**
+ * @brief Executa um comando num processo filho e espera que termine.
+ *
+ * @param args Vetor de argumentos terminado em NULL; args[0] é o nome do comando.
+ */
+static void executaComando(char **args)
+{
+    int status;
+
+    // Cria um novo processo
+    pid_t pid = fork();
+    if (pid == -1)
+    {
+        escreveTexto(2, "Erro na criação de um novo processo\n");
+    }
+    else if (pid == 0)
+    {
+        // Processo filho: executa o comando
+        char path[MAX_LENGTH];
+        snprintf(path, sizeof(path), "./%s", args[0]); // Assume que o comando é um ficheiro na mesma diretoria
+        if (execv(path, args) == -1)
+        {
+            escreveTexto(2, "Erro na execução do comando\n");
+            exit(EXIT_FAILURE);
+        }
+    }
+    else
+    {
+        // Processo pai: espera que o processo filho termine
+        waitpid(pid, &status, 0);
+        if (WIFEXITED(status))
+        {
+            char output[MAX_LENGTH];
+            snprintf(output, sizeof(output), "Terminou o comando %s com código %d\n", args[0], WEXITSTATUS(status));
+            escreveTexto(1, output);
+        }
+    }
+}
+
+/**
+ * @brief Distribui os operandos expandidos pelas execuções necessárias.
+ *
+ * @param comando Comando reconhecido.
+ * @param argumentos Nome do comando seguido dos operandos já expandidos.
+ */
+static void executaOperandos(const Comando *comando, ListaStrings *argumentos)
+{
+    size_t nOperandos = argumentos->n - 1;
+    char **operandos = argumentos->itens + 1;
+
+    if (comando->operandos == OPERANDOS_LITERAIS || nOperandos <= 1)
+    {
+        char **args = realoca(NULL, (argumentos->n + 1) * sizeof(char *));
+        memcpy(args, argumentos->itens, argumentos->n * sizeof(char *));
+        args[argumentos->n] = NULL;
+        executaComando(args);
+        free(args);
+        return;
+    }
+
+    // Espaço ocupado pelo nome do comando e pelos ponteiros terminais
+    size_t limite = comando->operandos == OPERANDOS_UM ? 0 : espacoArgumentos();
+    size_t fixo = strlen(argumentos->itens[0]) + 1 + 2 * sizeof(char *);
+    char **args = realoca(NULL, (nOperandos + 2) * sizeof(char *));
+    args[0] = argumentos->itens[0];
+
+    size_t i = 0;
+    while (i < nOperandos)
+    {
+        // Agrupa operandos enquanto couberem no limite (pelo menos um por execução)
+        size_t n = 0, usado = fixo;
+        do
+        {
+            usado += strlen(operandos[i + n]) + 1 + sizeof(char *);
+            args[1 + n] = operandos[i + n];
+            n++;
+        } while (i + n < nOperandos &&
+                 usado + strlen(operandos[i + n]) + 1 + sizeof(char *) <= limite);
+
+        args[1 + n] = NULL;
+        executaComando(args);
+        i += n;
+    }
+    free(args);
+}
 
 /**
  * @brief Função principal do interpretador.
@@ -35,19 +567,17 @@
 int main() 
 {
     char comando[MAX_LENGTH];
-    char *args[MAX_LENGTH / 2];
-    int status;
     char prompt[] = "% ";
 
     while (1) 
     {
         // Exibe a linha de comandos do interpretador
-        write(1, prompt, strlen(prompt));
+        escreveTexto(1, prompt);
 
         // Lê o comando do utilizador
         if (fgets(comando, MAX_LENGTH, stdin) == NULL) 
         {
-            write(2, "Erro na leitura do comando\n", 28);
+            escreveTexto(2, "Erro na leitura do comando\n");
             continue;
         }
 
@@ -70,69 +600,51 @@ int main()
         // Verifica se o comando é "help"
         if (strcmp(comando, "help") == 0) 
         {
-            write(1, "Comandos disponíveis:\n", 24);
-            write(1, "- mostra\n", 10);
-            write(1, "- copia\n", 9);
-            write(1, "- acrescenta\n", 14);
-            write(1, "- conta\n", 9);
-            write(1, "- apaga\n", 9);
-            write(1, "- informa\n", 11);
-            write(1, "- lista\n", 9);
-            write(1, "- termina\n", 11);
+            escreveTexto(1, "Comandos disponíveis:\n");
+            escreveTexto(1, "- mostra\n");
+            escreveTexto(1, "- copia\n");
+            escreveTexto(1, "- acrescenta\n");
+            escreveTexto(1, "- conta\n");
+            escreveTexto(1, "- apaga\n");
+            escreveTexto(1, "- informa\n");
+            escreveTexto(1, "- lista\n");
+            escreveTexto(1, "- termina\n");
             continue;
         }
 
         // Divide o comando em argumentos
-        int i = 0;
-        args[i] = strtok(comando, " ");
-        while (args[i] != NULL) 
+        char *token = strtok(comando, " ");
+        if (token == NULL)
         {
-            args[++i] = strtok(NULL, " ");
+            continue;
         }
 
         // Verifica se o comando é reconhecido
-        if (strcmp(args[0], "mostra") != 0 &&
-            strcmp(args[0], "copia") != 0 &&
-            strcmp(args[0], "acrescenta") != 0 &&
-            strcmp(args[0], "conta") != 0 &&
-            strcmp(args[0], "apaga") != 0 &&
-            strcmp(args[0], "informa") != 0 &&
-            strcmp(args[0], "lista") != 0) 
-        {
-            write(2, "Comando não reconhecido\n", 26);
-            write(1, "\nDigite 'help' para verificar comandos disponíveis\n", 53);
+        const Comando *cmd = NULL;
+        for (size_t c = 0; c < sizeof(comandos) / sizeof(comandos[0]); c++)
+        {
+            if (strcmp(token, comandos[c].nome) == 0)
+                cmd = &comandos[c];
+        }
+        if (cmd == NULL)
+        {
+            escreveTexto(2, "Comando não reconhecido\n");
+            escreveTexto(1, "\nDigite 'help' para verificar comandos disponíveis\n");
             continue;
         }
 
-        // Cria um novo processo
-        pid_t pid = fork();
-        if (pid == -1) 
-        {
-            write(2, "Erro na criação de um novo processo\n", 39);
-        } 
-        else if (pid == 0) 
+        // Expande os restantes argumentos (chavetas, curingas e '**')
+        ListaStrings argumentos = { 0 };
+        adicionaString(&argumentos, duplica(token, strlen(token)));
+        while ((token = strtok(NULL, " ")) != NULL)
         {
-            // Processo filho: executa o comando
-            char path[MAX_LENGTH];
-            sprintf(path, "./%s", args[0]); // Assume que o comando é um ficheiro na mesma diretoria
-            if (execv(path, args) == -1) 
-            {
-                write(2, "Erro na execução do comando\n", 31);
-                exit(EXIT_FAILURE);
-            }
-        } 
-        else 
-        {
-            // Processo pai: espera que o processo filho termine
-            waitpid(pid, &status, 0);
-            if (WIFEXITED(status)) 
-            {
-                char output[MAX_LENGTH];
-                sprintf(output, "Terminou o comando %s com código %d\n", args[0], WEXITSTATUS(status));
-                write(1, output, strlen(output));
-            }
+            expandeArgumento(token, &argumentos);
         }
+        limpaCache();
+
+        executaOperandos(cmd, &argumentos);
+        libertaLista(&argumentos);
     }
 
     return 0;
-}
\ No newline at end of file
+}
@@ -6,6 +6,12 @@
  * Se nenhum caminho for fornecido, o programa lista o conteúdo do diretório atual.
  * O programa exibe o tipo de cada item listado (diretório ou ficheiro) e o seu nome.
  * Se existirem erros durante a abertura ou leitura do diretório, são devolvidas mensagens de erro.
+ *
+ * Com a opção --dups, a diretoria é percorrida recursivamente e são listados os grupos de ficheiros com
+ * conteúdo duplicado. Os ficheiros são agrupados primeiro pelo tamanho, depois por um hash dos primeiros
+ * e últimos 4 KB e só os candidatos restantes são lidos por completo (em paralelo, com pread).
+ * Os grupos com o mesmo hash são confirmados byte a byte antes de serem listados.
+ * Ligações físicas ao mesmo inode são lidas uma única vez.
  */
 
 #include <unistd.h>     // Função write() e ao descritor de ficheiro STDERR
@@ -13,8 +19,597 @@
 #include <stdio.h>      // Função printf()
 #include <string.h>     // Funções relacionadas a strings
 #include <sys/stat.h>   // Struct stat e às funções relacionadas a atributos de ficheiros
+#include <fcntl.h>      // Função open()
+#include <stdlib.h>     // Funções de alocação de memória e qsort()
+#include <stdint.h>     // Tipos inteiros de tamanho fixo
+#include <pthread.h>    // Threads para o cálculo dos hashes
+
+#include "utilitarios.h"
 
 #define PATH_MAX_LEN 1024  // Tamanho máximo do caminho de um ficheiro
+#define DUPS_PONTA 4096    // Bytes lidos no início e no fim de cada ficheiro na comparação parcial
+#define DUPS_THREADS 8     // Número máximo de threads usadas no cálculo dos hashes
+#define DUPS_LEITURA (1 << 20)  // Bytes lidos de cada vez no hash completo (múltiplo de 32)
+
+#define PRIMO1 0x9E3779B185EBCA87ULL
+#define PRIMO2 0xC2B2AE3D27D4EB4FULL
+#define PRIMO3 0x165667B19E3779F9ULL
+#define PRIMO4 0x85EBCA77C2B2AE63ULL
+#define PRIMO5 0x27D4EB2F165667C5ULL
+
+/**
+ * @brief Caminho de um ficheiro regular encontrado na diretoria.
+ */
+typedef struct
+{
+    char *caminho;
+    dev_t dev;
+    ino_t ino;
+    off_t tam;
+} Ficheiro;
+
+/**
+ * @brief Inode distinto e respetivos hashes (partilhado por todas as ligações físicas).
+ */
+typedef struct
+{
+    size_t primeiro;    // Índice da primeira ligação no vetor de ficheiros
+    size_t ligacoes;    // Número de ligações físicas encontradas
+    off_t tam;
+    uint64_t parcial;   // Hash dos primeiros e últimos DUPS_PONTA bytes
+    uint64_t total;     // Hash do conteúdo completo
+    int erro;
+} Inode;
+
+/**
+ * @brief Trabalho repartido pelas threads de cálculo de hashes.
+ */
+typedef struct
+{
+    Inode **itens;
+    size_t n;
+    size_t seguinte;    // Próximo item a processar (acedido de forma atómica)
+    const Ficheiro *ficheiros;
+    void (*funcao)(Inode *, const Ficheiro *);
+} Trabalho;
+
+static Ficheiro *ficheiros;
+static size_t numFicheiros, capFicheiros;
+
+static inline uint64_t rodaEsquerda(uint64_t x, int r)
+{
+    return (x << r) | (x >> (64 - r));
+}
+
+static inline uint64_t le64(const unsigned char *p)
+{
+    uint64_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+static inline uint64_t ronda(uint64_t acc, uint64_t v)
+{
+    acc += v * PRIMO2;
+    acc = rodaEsquerda(acc, 31);
+    return acc * PRIMO1;
+}
+
+/**
+ * @brief Estado do hash de 64 bits, para conteúdos consumidos em vários blocos.
+ */
+typedef struct
+{
+    uint64_t v1, v2, v3, v4;
+    uint64_t semente;
+} EstadoHash;
+
+static void iniciaHash(EstadoHash *e, uint64_t semente)
+{
+    e->v1 = semente + PRIMO1 + PRIMO2;
+    e->v2 = semente + PRIMO2;
+    e->v3 = semente;
+    e->v4 = semente - PRIMO1;
+    e->semente = semente;
+}
+
+/**
+ * @brief Consome blocos de 32 bytes com quatro acumuladores independentes.
+ *
+ * Os acumuladores não dependem uns dos outros, o que permite ao compilador e ao processador
+ * tratá-los em paralelo.
+ */
+static void atualizaHash(EstadoHash *e, const unsigned char *p, size_t blocos)
+{
+    uint64_t v1 = e->v1, v2 = e->v2, v3 = e->v3, v4 = e->v4;
+    for (size_t i = 0; i < blocos; i++, p += 32)
+    {
+        v1 = ronda(v1, le64(p));
+        v2 = ronda(v2, le64(p + 8));
+        v3 = ronda(v3, le64(p + 16));
+        v4 = ronda(v4, le64(p + 24));
+    }
+    e->v1 = v1;
+    e->v2 = v2;
+    e->v3 = v3;
+    e->v4 = v4;
+}
+
+/**
+ * @brief Termina o hash com os últimos bytes (menos de 32) e o comprimento total.
+ */
+static uint64_t finalizaHash(const EstadoHash *e, const unsigned char *p, size_t n, uint64_t total)
+{
+    const unsigned char *fim = p + n;
+    uint64_t h;
+
+    if (total >= 32)
+    {
+        h = rodaEsquerda(e->v1, 1) + rodaEsquerda(e->v2, 7) + rodaEsquerda(e->v3, 12) + rodaEsquerda(e->v4, 18);
+        h = (h ^ ronda(0, e->v1)) * PRIMO1 + PRIMO4;
+        h = (h ^ ronda(0, e->v2)) * PRIMO1 + PRIMO4;
+        h = (h ^ ronda(0, e->v3)) * PRIMO1 + PRIMO4;
+        h = (h ^ ronda(0, e->v4)) * PRIMO1 + PRIMO4;
+    }
+    else
+    {
+        h = e->semente + PRIMO5;
+    }
+
+    h += total;
+    for (; p + 8 <= fim; p += 8)
+        h = rodaEsquerda(h ^ ronda(0, le64(p)), 27) * PRIMO1 + PRIMO4;
+    for (; p < fim; p++)
+        h = rodaEsquerda(h ^ (*p * PRIMO5), 11) * PRIMO1;
+
+    h ^= h >> 33;
+    h *= PRIMO2;
+    h ^= h >> 29;
+    h *= PRIMO3;
+    h ^= h >> 32;
+    return h;
+}
+
+/**
+ * @brief Hash de 64 bits ao estilo xxHash64 de um bloco de memória.
+ */
+static uint64_t calculaHash(const unsigned char *p, size_t n, uint64_t semente)
+{
+    EstadoHash e;
+    iniciaHash(&e, semente);
+    atualizaHash(&e, p, n / 32);
+    return finalizaHash(&e, p + n / 32 * 32, n % 32, n);
+}
+
+/**
+ * @brief Percorre recursivamente uma diretoria e guarda os ficheiros regulares não vazios.
+ *
+ * As ligações simbólicas não são seguidas.
+ */
+static void recolheFicheiros(const char *path)
+{
+    DIR *dir = opendir(path);
+    if (!dir)
+    {
+        escreveTexto(2, "Erro ao abrir diretoria ");
+        escreveTexto(2, path);
+        escreveTexto(2, "\n");
+        return;
+    }
+
+    struct dirent *entry;
+    while ((entry = readdir(dir)))
+    {
+        if (entry->d_name[0] == '.' && (entry->d_name[1] == '\0' ||
+            (entry->d_name[1] == '.' && entry->d_name[2] == '\0')))
+            continue;
+
+        char full_path[PATH_MAX_LEN];
+        size_t path_len = strlen(path);
+        size_t name_len = strlen(entry->d_name);
+        if (path_len + name_len + 2 > PATH_MAX_LEN)
+        {
+            escreveTexto(2, "Caminho muito extenso: ");
+            escreveTexto(2, path);
+            escreveTexto(2, "/");
+            escreveTexto(2, entry->d_name);
+            escreveTexto(2, "\n");
+            continue;
+        }
+        memcpy(full_path, path, path_len);
+        full_path[path_len] = '/';
+        memcpy(full_path + path_len + 1, entry->d_name, name_len + 1);
+
+        struct stat file_stat;
+        if (lstat(full_path, &file_stat) == -1)
+            continue;
+
+        if (S_ISDIR(file_stat.st_mode))
+        {
+            recolheFicheiros(full_path);
+        }
+        else if (S_ISREG(file_stat.st_mode) && file_stat.st_size > 0)
+        {
+            if (numFicheiros == capFicheiros)
+            {
+                capFicheiros = capFicheiros ? capFicheiros * 2 : 1024;
+                ficheiros = realoca(ficheiros, capFicheiros * sizeof(Ficheiro));
+            }
+            Ficheiro *f = &ficheiros[numFicheiros++];
+            f->caminho = realoca(NULL, path_len + name_len + 2);
+            memcpy(f->caminho, full_path, path_len + name_len + 2);
+            f->dev = file_stat.st_dev;
+            f->ino = file_stat.st_ino;
+            f->tam = file_stat.st_size;
+        }
+    }
+
+    closedir(dir);
+}
+
+/**
+ * @brief Calcula o hash dos primeiros e dos últimos DUPS_PONTA bytes de um ficheiro.
+ *
+ * Em ficheiros com até 2 * DUPS_PONTA bytes as duas pontas cobrem todo o conteúdo,
+ * pelo que este hash é também o hash total.
+ */
+static void hashParcial(Inode *inode, const Ficheiro *f)
+{
+    unsigned char buffer[2 * DUPS_PONTA];
+    size_t ponta = inode->tam < DUPS_PONTA ? (size_t)inode->tam : DUPS_PONTA;
+
+    int fd = open(f->caminho, O_RDONLY);
+    if (fd == -1)
+    {
+        inode->erro = 1;
+        return;
+    }
+    if (pread(fd, buffer, ponta, 0) != (ssize_t)ponta ||
+        pread(fd, buffer + ponta, ponta, inode->tam - ponta) != (ssize_t)ponta)
+    {
+        inode->erro = 1;
+        close(fd);
+        return;
+    }
+    close(fd);
+
+    inode->parcial = calculaHash(buffer, 2 * ponta, 0);
+    if (inode->tam <= 2 * DUPS_PONTA)
+        inode->total = inode->parcial;
+}
+
+/**
+ * @brief Calcula o hash de todo o conteúdo de um ficheiro, lido em blocos com pread().
+ *
+ * O ficheiro pode ter mudado desde a recolha: se o tamanho deixar de coincidir, o inode é marcado
+ * com erro e excluído dos resultados.
+ */
+static void hashTotal(Inode *inode, const Ficheiro *f)
+{
+    struct stat st;
+    int fd = open(f->caminho, O_RDONLY);
+    if (fd == -1)
+    {
+        inode->erro = 1;
+        return;
+    }
+    if (fstat(fd, &st) == -1 || st.st_size != inode->tam)
+    {
+        inode->erro = 1;
+        close(fd);
+        return;
+    }
+    posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+
+    unsigned char *buffer = realoca(NULL, DUPS_LEITURA);
+    EstadoHash e;
+    iniciaHash(&e, 0);
+
+    for (off_t pos = 0; pos < inode->tam && !inode->erro; )
+    {
+        size_t pedido = inode->tam - pos < DUPS_LEITURA ? (size_t)(inode->tam - pos) : DUPS_LEITURA;
+
+        // Preenche o bloco por completo; um fim de ficheiro antecipado indica que o ficheiro encolheu
+        size_t lidos = 0;
+        while (lidos < pedido)
+        {
+            ssize_t r = pread(fd, buffer + lidos, pedido - lidos, pos + lidos);
+            if (r <= 0)
+            {
+                inode->erro = 1;
+                break;
+            }
+            lidos += r;
+        }
+        if (inode->erro)
+            break;
+
+        // Só o último bloco pode ter um resto com menos de 32 bytes
+        pos += pedido;
+        atualizaHash(&e, buffer, pedido / 32);
+        if (pos == inode->tam)
+            inode->total = finalizaHash(&e, buffer + pedido / 32 * 32, pedido % 32, inode->tam);
+    }
+
+    free(buffer);
+    close(fd);
+}
+
+static void *executaTrabalho(void *arg)
+{
+    Trabalho *t = arg;
+    size_t i;
+    while ((i = __atomic_fetch_add(&t->seguinte, 1, __ATOMIC_RELAXED)) < t->n)
+        t->funcao(t->itens[i], &t->ficheiros[t->itens[i]->primeiro]);
+    return NULL;
+}
+
+/**
+ * @brief Aplica uma função de hash a uma lista de inodes, repartida por várias threads.
+ */
+static void calculaEmParalelo(Inode **itens, size_t n, void (*funcao)(Inode *, const Ficheiro *))
+{
+    Trabalho t = { itens, n, 0, ficheiros, funcao };
+    pthread_t threads[DUPS_THREADS];
+
+    long numThreads = sysconf(_SC_NPROCESSORS_ONLN);
+    if (numThreads < 1)
+        numThreads = 1;
+    if (numThreads > DUPS_THREADS)
+        numThreads = DUPS_THREADS;
+    if ((size_t)numThreads > n)
+        numThreads = n;
+
+    int criadas = 0;
+    while (criadas < numThreads && pthread_create(&threads[criadas], NULL, executaTrabalho, &t) == 0)
+        criadas++;
+
+    // Sem threads disponíveis, o trabalho é feito pela thread principal
+    executaTrabalho(&t);
+    for (int i = 0; i < criadas; i++)
+        pthread_join(threads[i], NULL);
+}
+
+static int comparaFicheiros(const void *a, const void *b)
+{
+    const Ficheiro *fa = a, *fb = b;
+    if (fa->dev != fb->dev)
+        return fa->dev < fb->dev ? -1 : 1;
+    if (fa->ino != fb->ino)
+        return fa->ino < fb->ino ? -1 : 1;
+    return strcmp(fa->caminho, fb->caminho);
+}
+
+static int comparaTamanho(const void *a, const void *b)
+{
+    const Inode *ia = *(Inode *const *)a, *ib = *(Inode *const *)b;
+    if (ia->tam != ib->tam)
+        return ia->tam > ib->tam ? -1 : 1;
+    return 0;
+}
+
+static int comparaParcial(const void *a, const void *b)
+{
+    const Inode *ia = *(Inode *const *)a, *ib = *(Inode *const *)b;
+    if (ia->tam != ib->tam)
+        return ia->tam > ib->tam ? -1 : 1;
+    if (ia->parcial != ib->parcial)
+        return ia->parcial < ib->parcial ? -1 : 1;
+    return 0;
+}
+
+static int comparaTotal(const void *a, const void *b)
+{
+    const Inode *ia = *(Inode *const *)a, *ib = *(Inode *const *)b;
+    int r = comparaParcial(a, b);
+    if (r != 0)
+        return r;
+    if (ia->total != ib->total)
+        return ia->total < ib->total ? -1 : 1;
+    return 0;
+}
+
+static int comparaTotalCaminho(const void *a, const void *b)
+{
+    const Inode *ia = *(Inode *const *)a, *ib = *(Inode *const *)b;
+    int r = comparaTotal(a, b);
+    if (r != 0)
+        return r;
+    return strcmp(ficheiros[ia->primeiro].caminho, ficheiros[ib->primeiro].caminho);
+}
+
+/**
+ * @brief Mantém apenas os inodes que pertencem a um grupo com pelo menos dois elementos.
+ *
+ * @param itens Inodes ordenados pelo critério de comparação.
+ * @param n Número de inodes.
+ * @param compara Critério que define os grupos.
+ * @return Número de inodes mantidos no início do vetor.
+ */
+static size_t filtraGrupos(Inode **itens, size_t n, int (*compara)(const void *, const void *))
+{
+    size_t mantidos = 0;
+    for (size_t i = 0; i < n; )
+    {
+        size_t j = i + 1;
+        while (j < n && compara(&itens[i], &itens[j]) == 0)
+            j++;
+        if (j - i > 1)
+        {
+            for (size_t k = i; k < j; k++)
+            {
+                if (!itens[k]->erro)
+                    itens[mantidos++] = itens[k];
+            }
+        }
+        i = j;
+    }
+    return mantidos;
+}
+
+/**
+ * @brief Confirma byte a byte que dois inodes com o mesmo hash têm o mesmo conteúdo.
+ *
+ * Os hashes não são criptográficos, pelo que uma colisão não basta para declarar dois ficheiros
+ * duplicados. Uma leitura curta (ficheiro alterado) conta como conteúdo diferente.
+ *
+ * @return Retorna 1 se os conteúdos forem iguais, 0 caso contrário.
+ */
+static int conteudoIgual(const Inode *a, const Inode *b)
+{
+    int fdA = open(ficheiros[a->primeiro].caminho, O_RDONLY);
+    int fdB = open(ficheiros[b->primeiro].caminho, O_RDONLY);
+    unsigned char *bufA = realoca(NULL, DUPS_LEITURA);
+    unsigned char *bufB = realoca(NULL, DUPS_LEITURA);
+    int igual = fdA != -1 && fdB != -1 && a->tam == b->tam;
+
+    for (off_t pos = 0; igual && pos < a->tam; )
+    {
+        size_t pedido = a->tam - pos < DUPS_LEITURA ? (size_t)(a->tam - pos) : DUPS_LEITURA;
+        size_t lidosA = 0, lidosB = 0;
+        ssize_t r;
+
+        while (lidosA < pedido && (r = pread(fdA, bufA + lidosA, pedido - lidosA, pos + lidosA)) > 0)
+            lidosA += r;
+        while (lidosB < pedido && (r = pread(fdB, bufB + lidosB, pedido - lidosB, pos + lidosB)) > 0)
+            lidosB += r;
+
+        igual = lidosA == pedido && lidosB == pedido && memcmp(bufA, bufB, pedido) == 0;
+        pos += pedido;
+    }
+
+    if (fdA != -1)
+        close(fdA);
+    if (fdB != -1)
+        close(fdB);
+    free(bufA);
+    free(bufB);
+    return igual;
+}
+
+/**
+ * @brief Escreve um grupo de duplicados: todas as ligações de cada inode, marcando as ligações físicas adicionais.
+ */
+static void escreveGrupo(Inode **membros, size_t n)
+{
+    size_t numCaminhos = 0;
+    for (size_t k = 0; k < n; k++)
+        numCaminhos += membros[k]->ligacoes;
+
+    char cabecalho[PATH_MAX_LEN];
+    snprintf(cabecalho, sizeof(cabecalho), "[duplicados] %zu ficheiros de %lld bytes\n",
+             numCaminhos, (long long)membros[0]->tam);
+    escreveTexto(1, cabecalho);
+    for (size_t k = 0; k < n; k++)
+    {
+        for (size_t l = 0; l < membros[k]->ligacoes; l++)
+        {
+            escreveTexto(1, ficheiros[membros[k]->primeiro + l].caminho);
+            if (l > 0)
+                escreveTexto(1, " [ligação física]");
+            escreveTexto(1, "\n");
+        }
+    }
+    escreveTexto(1, "\n");
+}
+
+/**
+ * @brief Lista os grupos de ficheiros duplicados de uma diretoria.
+ *
+ * @param path Caminho da diretoria.
+ * @return Retorna 0 em caso de sucesso, 1 em caso de erro.
+ */
+static int listaDuplicados(const char *path)
+{
+    DIR *dir = opendir(path);
+    if (!dir)
+    {
+        escreveTexto(2, "Erro ao abrir diretoria ");
+        escreveTexto(2, path);
+        escreveTexto(2, "\n");
+        return 1;
+    }
+    closedir(dir);
+
+    recolheFicheiros(path);
+
+    // Agrupa as ligações físicas pelo par (dev, inode)
+    qsort(ficheiros, numFicheiros, sizeof(Ficheiro), comparaFicheiros);
+    Inode *inodes = realoca(NULL, (numFicheiros + 1) * sizeof(Inode));
+    size_t numInodes = 0;
+    for (size_t i = 0; i < numFicheiros; i++)
+    {
+        if (i > 0 && ficheiros[i].dev == ficheiros[i - 1].dev && ficheiros[i].ino == ficheiros[i - 1].ino)
+        {
+            inodes[numInodes - 1].ligacoes++;
+            continue;
+        }
+        Inode *inode = &inodes[numInodes++];
+        inode->primeiro = i;
+        inode->ligacoes = 1;
+        inode->tam = ficheiros[i].tam;
+        inode->parcial = inode->total = 0;
+        inode->erro = 0;
+    }
+
+    Inode **itens = realoca(NULL, (numInodes + 1) * sizeof(Inode *));
+    for (size_t i = 0; i < numInodes; i++)
+        itens[i] = &inodes[i];
+
+    // 1. Tamanho
+    qsort(itens, numInodes, sizeof(Inode *), comparaTamanho);
+    size_t n = filtraGrupos(itens, numInodes, comparaTamanho);
+
+    // 2. Primeiros e últimos DUPS_PONTA bytes
+    calculaEmParalelo(itens, n, hashParcial);
+    qsort(itens, n, sizeof(Inode *), comparaParcial);
+    n = filtraGrupos(itens, n, comparaParcial);
+
+    // 3. Conteúdo completo, só para os ficheiros que as pontas não cobrem
+    size_t numGrandes = 0;
+    while (numGrandes < n && itens[numGrandes]->tam > 2 * DUPS_PONTA)
+        numGrandes++;
+    calculaEmParalelo(itens, numGrandes, hashTotal);
+    qsort(itens, n, sizeof(Inode *), comparaTotalCaminho);
+    n = filtraGrupos(itens, n, comparaTotal);
+
+    // 4. Confirmação byte a byte: dentro de cada grupo com o mesmo hash, cada duplicado é comparado
+    // com o primeiro inode ainda sem grupo
+    Inode **membros = realoca(NULL, (n + 1) * sizeof(Inode *));
+    for (size_t i = 0; i < n; )
+    {
+        size_t j = i + 1;
+        while (j < n && comparaTotal(&itens[i], &itens[j]) == 0)
+            j++;
+
+        for (size_t a = i; a < j; a++)
+        {
+            if (itens[a] == NULL)
+                continue;
+            size_t m = 0;
+            membros[m++] = itens[a];
+            for (size_t b = a + 1; b < j; b++)
+            {
+                if (itens[b] != NULL && conteudoIgual(itens[a], itens[b]))
+                {
+                    membros[m++] = itens[b];
+                    itens[b] = NULL;
+                }
+            }
+            if (m > 1)
+                escreveGrupo(membros, m);
+        }
+        i = j;
+    }
+    free(membros);
+
+    for (size_t i = 0; i < numFicheiros; i++)
+        free(ficheiros[i].caminho);
+    free(ficheiros);
+    free(inodes);
+    free(itens);
+    return 0;
+}
 
 /**
  * @brief Função principal do programa.
@@ -27,6 +622,17 @@ int main(int argc, char *argv[])
 {
     const char *path;   // Caminho do diretório que será listado
 
+    // Procura de ficheiros duplicados
+    if (argc >= 2 && strcmp(argv[1], "--dups") == 0)
+    {
+        if (argc > 3)
+        {
+            escreveUso(argv[0], " --dups [diretoria]");
+            return 1;
+        }
+        return listaDuplicados(argc == 3 ? argv[2] : ".");
+    }
+
     // Verifica se o número de argumentos é correto
     if (argc == 2) 
     {
@@ -36,9 +642,7 @@ int main(int argc, char *argv[])
         path = ".";      // Se nenhum caminho for fornecido, usa o diretório atual
     } else {
         // Se o número de argumentos for inválido, devolve uma mensagem para passar os argumentos corretos
-        write(2, "Erro: Digite os argumentos: ", 29);
-        write(2, argv[0], strlen(argv[0]));
-        write(2, "\n", 1);
+        escreveUso(argv[0], "");
         return 1;
     }
 
@@ -47,7 +651,7 @@ int main(int argc, char *argv[])
     if (!dir) 
     {
         // Se ocorrer um erro ao abrir o diretório, imprime uma mensagem de erro
-        write(2, "Erro ao abrir diretoria\n", 25);
+        escreveTexto(2, "Erro ao abrir diretoria\n");
         return 1;
     }
 
@@ -64,7 +668,7 @@ int main(int argc, char *argv[])
         if (path_len + name_len + 2 > PATH_MAX_LEN) 
         {
             // Se o caminho for muito extenso, imprime uma mensagem de erro
-            write(2, "Caminho muito extenso\n", 20);
+            escreveTexto(2, "Caminho muito extenso\n");
             closedir(dir);
             return 1;
         }
@@ -78,11 +682,11 @@ int main(int argc, char *argv[])
 
         // Determina o tipo do item (diretório ou ficheiro) e exibe-o juntamente com o nome
         const char *type = S_ISDIR(file_stat.st_mode) ? "[diretoria]" : "[ficheiro]";
-        write(1, type, strlen(type));
-        write(1, " ", 1);
-        write(1, entry->d_name, strlen(entry->d_name));
-        write(1, S_ISDIR(file_stat.st_mode) ? "/" : "", S_ISDIR(file_stat.st_mode) ? 1 : 0);
-        write(1, "\n", 1);
+        escreveTexto(1, type);
+        escreveTexto(1, " ");
+        escreveTexto(1, entry->d_name);
+        escreveTexto(1, S_ISDIR(file_stat.st_mode) ? "/" : "");
+        escreveTexto(1, "\n");
     }
 
     closedir(dir);
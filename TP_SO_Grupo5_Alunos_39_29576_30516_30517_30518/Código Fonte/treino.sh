@@ -0,0 +1,116 @@
+#!/bin/sh
+#
+# treino.sh - carga de trabalho representativa para o ciclo PGO e para comparar versões.
+#
+# Utilização:
+#   ./treino.sh <diretoria_binarios> [repeticoes]
+#       Executa a carga de trabalho com os binários indicados e mostra o tempo total.
+#   ./treino.sh -c <binarios_antes> <binarios_depois> [repeticoes]
+#       Executa a carga de trabalho com as duas versões e compara os tempos.
+#
+# Os dados são gerados de forma determinística numa diretoria temporária, para que o perfil
+# recolhido e os tempos medidos sejam reprodutíveis.
+
+set -e
+
+PROGRAMAS="int acrescenta apaga conta copia informa lista mostra"
+
+# Gera a árvore de dados de treino em $1
+gera_dados() {
+    mkdir -p "$1/dados"
+    awk -v raiz="$1/dados" 'BEGIN {
+        srand(42)
+        split("a b c d e f g h", dirs, " ")
+        for (d = 1; d <= 8; d++) {
+            system("mkdir -p " raiz "/" dirs[d])
+            for (f = 1; f <= 25; f++) {
+                nome = raiz "/" dirs[d] "/f" f ".txt"
+                linhas = 20 + int(rand() * 200)
+                for (l = 0; l < linhas; l++)
+                    printf "%d %s linha %d %08x\n", l, dirs[d], int(rand() * 1000), int(rand() * 2147483647) > nome
+                close(nome)
+            }
+        }
+        for (l = 0; l < 400000; l++)
+            printf "%010d %08x %08x %08x\n", l, int(rand() * 2147483647), int(rand() * 2147483647), l * 7 > (raiz "/../grande.bin")
+    }'
+
+    # Duplicados e ligações físicas para lista --dups
+    for d in a b c; do
+        cp "$1/dados/$d/f1.txt" "$1/dados/h/dup_$d.txt"
+    done
+    cp "$1/grande.bin" "$1/dados/grande_dup.bin"
+    ln "$1/dados/a/f2.txt" "$1/dados/b/ligacao_f2.txt"
+}
+
+# Executa uma vez a carga de trabalho na diretoria $1
+executa_carga() {
+    cd "$1"
+    cp grande.bin copia.bin
+    cp grande.bin extra.bin
+
+    # Sequência de comandos no interpretador
+    ./int > /dev/null 2>&1 <<'FIM'
+help
+conta dados/**/*.txt
+mostra dados/*/f{1,2,3}*.txt
+informa dados/{a,b}/f1*.txt
+lista dados
+lista --dups dados
+copia --delta grande.bin copia.bin
+acrescenta dados/a/f1.txt extra.bin
+comando_inexistente
+termina
+FIM
+
+    # Programas chamados diretamente
+    printf 'X' | dd of=grande.bin bs=1 seek=3000000 conv=notrunc 2>/dev/null
+    ./copia --delta grande.bin copia.bin > /dev/null
+    ./copia grande.bin > /dev/null
+    ./mostra grande.bin > /dev/null
+    ./lista --dups dados > /dev/null
+    ./conta dados/*/f1*.txt > /dev/null
+    ./apaga ficheiro.copia copia.bin extra.bin > /dev/null
+    cd - > /dev/null
+}
+
+# Mede o tempo (em segundos) de $2 repetições da carga com os binários de $1
+mede() {
+    trabalho=$(mktemp -d)
+    for p in $PROGRAMAS; do
+        cp "$1/$p" "$trabalho/"
+    done
+    gera_dados "$trabalho"
+
+    inicio=$(date +%s%N)
+    i=0
+    while [ "$i" -lt "$2" ]; do
+        executa_carga "$trabalho"
+        i=$((i + 1))
+    done
+    fim=$(date +%s%N)
+
+    rm -rf "$trabalho"
+    awk -v ns=$((fim - inicio)) 'BEGIN { printf "%.3f\n", ns / 1e9 }'
+}
+
+if [ "$1" = "-c" ]; then
+    if [ $# -lt 3 ]; then
+        echo "Utilização: $0 -c <binarios_antes> <binarios_depois> [repeticoes]" >&2
+        exit 1
+    fi
+    repeticoes=${4:-5}
+    antes=$(mede "$2" "$repeticoes")
+    depois=$(mede "$3" "$repeticoes")
+    echo "Comparação ($repeticoes repetições da carga de treino):"
+    echo "  antes  ($2): $antes s"
+    echo "  depois ($3): $depois s"
+    awk -v a="$antes" -v d="$depois" 'BEGIN { if (d > 0) printf "  aceleração: %.2fx\n", a / d }'
+else
+    if [ $# -lt 1 ]; then
+        echo "Utilização: $0 <diretoria_binarios> [repeticoes]" >&2
+        exit 1
+    fi
+    repeticoes=${2:-1}
+    echo "$1: $(mede "$1" "$repeticoes") s ($repeticoes repetições)"
+fi
@@ -0,0 +1,49 @@
+/**
+ * @file utilitarios.c
+ * @brief Implementação das funções de escrita e de alocação partilhadas pelos programas.
+ */
+
+#include <unistd.h>    // Função write()
+#include <stdlib.h>    // Funções realloc() e exit()
+#include <string.h>    // Função strlen()
+
+#include "utilitarios.h"
+
+void escreveTexto(int fd, const char *texto)
+{
+    write(fd, texto, strlen(texto));
+}
+
+void escreveNumero(int fd, unsigned long long valor)
+{
+    char numero[20];
+    int len = sizeof(numero);
+
+    // Preenche o buffer do fim para o início e escreve-o numa única chamada
+    do 
+    {
+        numero[--len] = valor % 10 + '0';
+        valor /= 10;
+    } while (valor);
+
+    write(fd, numero + len, sizeof(numero) - len);
+}
+
+void escreveUso(const char *programa, const char *argumentos)
+{
+    escreveTexto(2, "Erro: Digite os argumentos: ");
+    escreveTexto(2, programa);
+    escreveTexto(2, argumentos);
+    escreveTexto(2, "\n");
+}
+
+void *realoca(void *ptr, size_t tam)
+{
+    ptr = realloc(ptr, tam);
+    if (ptr == NULL) 
+    {
+        escreveTexto(2, "Erro na alocação de memória\n");
+        exit(EXIT_FAILURE);
+    }
+    return ptr;
+}
@@ -0,0 +1,46 @@
+/**
+ * @file utilitarios.h
+ * @brief Funções de escrita e de alocação partilhadas pelos programas do interpretador.
+ *
+ * Estas funções são compiladas na biblioteca estática libutilitarios.a, ligada a todos os programas.
+ */
+
+#ifndef UTILITARIOS_H
+#define UTILITARIOS_H
+
+#include <stddef.h>
+
+/**
+ * @brief Escreve uma string terminada em '\0' num descritor de ficheiro.
+ *
+ * @param fd Descritor de ficheiro.
+ * @param texto String a escrever.
+ */
+void escreveTexto(int fd, const char *texto);
+
+/**
+ * @brief Escreve um número inteiro não negativo, em decimal, num descritor de ficheiro.
+ *
+ * @param fd Descritor de ficheiro.
+ * @param valor Número a escrever.
+ */
+void escreveNumero(int fd, unsigned long long valor);
+
+/**
+ * @brief Escreve no stderr a mensagem de utilização de um programa.
+ *
+ * @param programa Nome do programa (argv[0]).
+ * @param argumentos Descrição dos argumentos esperados, sem mudança de linha.
+ */
+void escreveUso(const char *programa, const char *argumentos);
+
+/**
+ * @brief Realoca um bloco de memória, terminando o programa se não existir memória disponível.
+ *
+ * @param ptr Bloco a realocar, ou NULL para alocar um novo.
+ * @param tam Novo tamanho em bytes.
+ * @return Ponteiro para o bloco realocado.
+ */
+void *realoca(void *ptr, size_t tam);
+
+#endif